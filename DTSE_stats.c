@@ -0,0 +1,426 @@
+/********************************************************************************
+ * Schneider-Electric                                                           *
+ * Global Solutions - Digital Services Transformation                           *
+ * Digital Services Platform                                                    *
+ * Copyright (c) 2026 - All rights reserved.                                    *
+ *                                                                              *
+ * No part of this document may be reproduced in any form without the           *
+ * express written consent of Schneider-Electric.                               *
+ ********************************************************************************/
+
+/**
+ * @file
+ * DTSE hot path instrumentation, see DTSE_stats.h
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "DTSE_stats.h"
+
+#define STATS_ERROR				(-1)	/**<  Returned when the statistics are not compiled in */
+#define STATS_TRACE_SIZE		4096	/**<  Maximum size of a query trace */
+
+static const char * stats_timersNames[DTSE_STATS_NB_TIMERS] = {
+	"query", "parse", "tag_resolution", "value_read", "teardown", "ts_scan", "ts_insert",
+	"DM_GetDevice", "DM_GetDeviceVariablesId", "DM_GetDeviceTags", "DM_GetDeviceParentId",
+	"DM_GetDeviceChildrenId", "DM_GetVariable", "DM_GetVariableType", "DM_GetVariableValue",
+	"DM_GetVariableTags", "DM_GetDevices_ByTags", "DM_GetVariables_ByTags", "DM_SetVariable",
+	"DM_FreeNode", "DM_Open_Query_Session", "DM_Close_Query_Session"
+};
+
+static const char * stats_countersNames[DTSE_STATS_NB_COUNTERS] = {
+	"points_ingested", "points_scanned", "points_returned", "chunks_decoded"
+};
+
+const char * DTSE_Stats_TimerName(stats_timer timer)
+{
+	return (unsigned) timer < DTSE_STATS_NB_TIMERS ? stats_timersNames[timer] : "unknown";
+}
+
+const char * DTSE_Stats_CounterName(stats_counter counter)
+{
+	return (unsigned) counter < DTSE_STATS_NB_COUNTERS ? stats_countersNames[counter] : "unknown";
+}
+
+unsigned long long DTSE_Stats_Percentile(const s_TimerStats * timer, double percentile)
+{
+	unsigned long long rank, cumulated = 0;
+	DTSE_int b;
+
+	if (timer->calls == 0)
+		return 0;
+
+	rank = (unsigned long long)(percentile / 100.0 * timer->calls + 0.5);
+	if (rank < 1)
+		rank = 1;
+	for (b = 0; b < DTSE_STATS_HISTOGRAM_SIZE - 1; b++)
+	{
+		cumulated += timer->histogram[b];
+		if (cumulated >= rank)
+		{
+			unsigned long long bound = 2ULL << b;
+			return bound < timer->maxNs ? bound : timer->maxNs;
+		}
+	}
+	return timer->maxNs;
+}
+
+#ifdef DTSE_ENABLE_STATS
+
+/* the instrumentation relies on POSIX (pthread, clock_gettime) and on thread local storage */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define STATS_THREAD_LOCAL		_Thread_local
+#elif defined(__GNUC__)
+#define STATS_THREAD_LOCAL		__thread
+#else
+#error "DTSE_ENABLE_STATS requires a C11 or GNU C compiler supporting thread local storage"
+#endif
+
+/* the trace settings are read by all the recording threads while DTSE_Stats_SetTrace() may change them */
+#if defined(__GNUC__)
+#define STATS_LOAD(variable)			__atomic_load_n(&(variable), __ATOMIC_ACQUIRE)
+#define STATS_STORE(variable, value)	__atomic_store_n(&(variable), (value), __ATOMIC_RELEASE)
+#else
+#define STATS_LOAD(variable)			(variable)
+#define STATS_STORE(variable, value)	((variable) = (value))
+#endif
+
+/*=============================================================================
+                              Structures
+==============================================================================*/
+
+/* Statistics of a thread, only written by their owner */
+typedef struct StatsThread_struct	s_StatsThread;
+
+struct StatsThread_struct
+{
+	s_TimerStats			timers[DTSE_STATS_NB_TIMERS];
+	unsigned long long		counters[DTSE_STATS_NB_COUNTERS];
+
+	/* current query, its per query copies are only kept when the trace is enabled */
+	const char *			query;
+	DTSE_int				tracing;
+	unsigned long long		queryStart;
+	unsigned long long		queryCalls[DTSE_STATS_NB_TIMERS];
+	unsigned long long		queryNs[DTSE_STATS_NB_TIMERS];
+	unsigned long long		queryCounters[DTSE_STATS_NB_COUNTERS];
+
+	s_StatsThread *			next;
+	s_StatsThread *			previous;
+};
+
+/*=============================================================================
+                              Globals
+==============================================================================*/
+
+static s_StatsThread *			stats_threads = NULL;
+static pthread_mutex_t			stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static STATS_THREAD_LOCAL s_StatsThread *	stats_local = NULL;
+
+/* the block of a thread is released when it exits, after its totals are added here */
+static s_Stats					stats_retired;
+static pthread_key_t			stats_key;
+static pthread_once_t			stats_keyOnce = PTHREAD_ONCE_INIT;
+static DTSE_int					stats_keyCreated = 0;
+
+typedef void (*stats_handler)(const char * trace);
+
+static unsigned long long		stats_traceThresholdNs = 0;
+static stats_handler			stats_traceHandler = NULL;
+
+/*=============================================================================
+                              Local functions
+==============================================================================*/
+
+/* Adds the statistics of a thread to a snapshot, the caller holds stats_lock */
+static void stats_merge(s_Stats * stats, const s_TimerStats * timers, const unsigned long long * counters)
+{
+	DTSE_int t, c, b;
+
+	for (t = 0; t < DTSE_STATS_NB_TIMERS; t++)
+	{
+		const s_TimerStats * src = &timers[t];
+		s_TimerStats * dst = &stats->timers[t];
+
+		dst->calls   += src->calls;
+		dst->totalNs += src->totalNs;
+		if (src->maxNs > dst->maxNs)
+			dst->maxNs = src->maxNs;
+		for (b = 0; b < DTSE_STATS_HISTOGRAM_SIZE; b++)
+			dst->histogram[b] += src->histogram[b];
+	}
+	for (c = 0; c < DTSE_STATS_NB_COUNTERS; c++)
+		stats->counters[c] += counters[c];
+	stats->threads++;
+}
+
+/* Called when a thread exits : keeps its totals and releases its block */
+static void stats_retire(void * block)
+{
+	s_StatsThread * local = block;
+
+	pthread_mutex_lock(&stats_lock);
+	stats_merge(&stats_retired, local->timers, local->counters);
+	if (local->previous != NULL)
+		local->previous->next = local->next;
+	else
+		stats_threads = local->next;
+	if (local->next != NULL)
+		local->next->previous = local->previous;
+	pthread_mutex_unlock(&stats_lock);
+
+	/* a later record from another key destructor registers a new block */
+	stats_local = NULL;
+	free(local);
+}
+
+static void stats_createKey(void)
+{
+	stats_keyCreated = pthread_key_create(&stats_key, stats_retire) == 0;
+}
+
+static s_StatsThread * stats_register(void)
+{
+	s_StatsThread * local;
+
+	pthread_once(&stats_keyOnce, stats_createKey);
+	if (!stats_keyCreated || (local = calloc(1, sizeof(s_StatsThread))) == NULL)
+		return NULL;
+	if (pthread_setspecific(stats_key, local) != 0)
+	{
+		free(local);
+		return NULL;
+	}
+
+	pthread_mutex_lock(&stats_lock);
+	local->next = stats_threads;
+	if (stats_threads != NULL)
+		stats_threads->previous = local;
+	stats_threads = local;
+	pthread_mutex_unlock(&stats_lock);
+
+	stats_local = local;
+	return local;
+}
+
+static DTSE_int stats_bucket(unsigned long long ns)
+{
+	DTSE_int b;
+
+	if (ns < 2)
+		return 0;
+#if defined(__GNUC__)
+	b = 63 - __builtin_clzll(ns);
+#else
+	for (b = 0; ns >> (b + 1); b++)
+		;
+#endif
+	return b < DTSE_STATS_HISTOGRAM_SIZE ? b : DTSE_STATS_HISTOGRAM_SIZE - 1;
+}
+
+static void stats_defaultHandler(const char * trace)
+{
+	fputs(trace, stderr);
+}
+
+static void stats_trace(const s_StatsThread * local, unsigned long long totalNs, DTSE_STATUS status)
+{
+	stats_handler handler = STATS_LOAD(stats_traceHandler);
+	char trace[STATS_TRACE_SIZE];
+	size_t len;
+	DTSE_int t, c;
+
+	len = snprintf(trace, sizeof(trace), "DTSE query trace: \"%s\" status=%d total=%.3f ms\n"
+			"  %-26s %10s %12s %7s\n",
+			local->query, (int) status, totalNs / 1e6, "stage", "calls", "time_ms", "%");
+
+	for (t = DTSE_STATS_STAGE_QUERY + 1; t < DTSE_STATS_NB_TIMERS && len < sizeof(trace); t++)
+	{
+		if (local->queryCalls[t] == 0)
+			continue;
+		len += snprintf(trace + len, sizeof(trace) - len, "  %-26s %10llu %12.3f %6.1f%%\n",
+				stats_timersNames[t], local->queryCalls[t], local->queryNs[t] / 1e6,
+				totalNs > 0 ? 100.0 * local->queryNs[t] / totalNs : 0.0);
+	}
+
+	for (c = 0; c < DTSE_STATS_NB_COUNTERS && len < sizeof(trace); c++)
+	{
+		len += snprintf(trace + len, sizeof(trace) - len, "%s%s=%llu%s",
+				c == 0 ? "  " : " ", stats_countersNames[c], local->queryCounters[c],
+				c == DTSE_STATS_NB_COUNTERS - 1 ? "\n" : "");
+	}
+
+	(handler != NULL ? handler : stats_defaultHandler)(trace);
+}
+
+/*=============================================================================
+                              Statistics API
+==============================================================================*/
+
+unsigned long long DTSE_Stats_Now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long) ts.tv_sec * 1000000000ULL + (unsigned long long) ts.tv_nsec;
+}
+
+void DTSE_Stats_Record(stats_timer timer, unsigned long long ns)
+{
+	s_StatsThread * local = stats_local != NULL ? stats_local : stats_register();
+	s_TimerStats * stats;
+
+	if (local == NULL || (unsigned) timer >= DTSE_STATS_NB_TIMERS)
+		return;
+
+	stats = &local->timers[timer];
+	stats->calls++;
+	stats->totalNs += ns;
+	if (ns > stats->maxNs)
+		stats->maxNs = ns;
+	stats->histogram[stats_bucket(ns)]++;
+
+	if (local->tracing)
+	{
+		local->queryCalls[timer]++;
+		local->queryNs[timer] += ns;
+	}
+}
+
+void DTSE_Stats_Add(stats_counter counter, unsigned long long value)
+{
+	s_StatsThread * local = stats_local != NULL ? stats_local : stats_register();
+
+	if (local == NULL || (unsigned) counter >= DTSE_STATS_NB_COUNTERS)
+		return;
+
+	local->counters[counter] += value;
+	if (local->tracing)
+		local->queryCounters[counter] += value;
+}
+
+void DTSE_Stats_QueryBegin(const char * query)
+{
+	s_StatsThread * local = stats_local != NULL ? stats_local : stats_register();
+
+	if (local == NULL)
+		return;
+
+	local->tracing = STATS_LOAD(stats_traceThresholdNs) > 0;
+	if (local->tracing)
+	{
+		memset(local->queryCalls, 0, sizeof(local->queryCalls));
+		memset(local->queryNs, 0, sizeof(local->queryNs));
+		memset(local->queryCounters, 0, sizeof(local->queryCounters));
+	}
+	local->query = query != NULL ? query : "";
+	local->queryStart = DTSE_Stats_Now();
+}
+
+void DTSE_Stats_QueryEnd(DTSE_STATUS status)
+{
+	s_StatsThread * local = stats_local;
+	unsigned long long elapsed, threshold;
+
+	if (local == NULL || local->query == NULL)
+		return;
+
+	elapsed = DTSE_Stats_Now() - local->queryStart;
+	DTSE_Stats_Record(DTSE_STATS_STAGE_QUERY, elapsed);
+
+	if (local->tracing)
+	{
+		threshold = STATS_LOAD(stats_traceThresholdNs);
+		if (threshold > 0 && elapsed >= threshold)
+			stats_trace(local, elapsed, status);
+	}
+	local->query = NULL;
+	local->tracing = 0;
+}
+
+void DTSE_Stats_SetTrace(unsigned long long thresholdUs, void (*handler)(const char * trace))
+{
+	/* the handler is published first, a thread seeing the new threshold uses the new handler */
+	STATS_STORE(stats_traceHandler, handler);
+	STATS_STORE(stats_traceThresholdNs, thresholdUs * 1000ULL);
+}
+
+DTSE_STATUS DTSE_Stats_Get(s_Stats * stats)
+{
+	s_StatsThread * local;
+
+	pthread_mutex_lock(&stats_lock);
+	*stats = stats_retired;
+	for (local = stats_threads; local != NULL; local = local->next)
+		stats_merge(stats, local->timers, local->counters);
+	pthread_mutex_unlock(&stats_lock);
+
+	return DTSE_SUCCESS;
+}
+
+void DTSE_Stats_Reset(void)
+{
+	s_StatsThread * local;
+
+	pthread_mutex_lock(&stats_lock);
+	memset(&stats_retired, 0, sizeof(stats_retired));
+	for (local = stats_threads; local != NULL; local = local->next)
+	{
+		memset(local->timers, 0, sizeof(local->timers));
+		memset(local->counters, 0, sizeof(local->counters));
+	}
+	pthread_mutex_unlock(&stats_lock);
+}
+
+#else /* DTSE_ENABLE_STATS */
+
+unsigned long long DTSE_Stats_Now(void)
+{
+	return 0;
+}
+
+void DTSE_Stats_Record(stats_timer timer, unsigned long long ns)
+{
+	(void) timer;
+	(void) ns;
+}
+
+void DTSE_Stats_Add(stats_counter counter, unsigned long long value)
+{
+	(void) counter;
+	(void) value;
+}
+
+void DTSE_Stats_QueryBegin(const char * query)
+{
+	(void) query;
+}
+
+void DTSE_Stats_QueryEnd(DTSE_STATUS status)
+{
+	(void) status;
+}
+
+void DTSE_Stats_SetTrace(unsigned long long thresholdUs, void (*handler)(const char * trace))
+{
+	(void) thresholdUs;
+	(void) handler;
+}
+
+DTSE_STATUS DTSE_Stats_Get(s_Stats * stats)
+{
+	memset(stats, 0, sizeof(s_Stats));
+	return STATS_ERROR;
+}
+
+void DTSE_Stats_Reset(void)
+{
+}
+
+#endif /* DTSE_ENABLE_STATS */
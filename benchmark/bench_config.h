@@ -0,0 +1,72 @@
+/********************************************************************************
+ * Schneider-Electric                                                           *
+ * Global Solutions - Digital Services Transformation                           *
+ * Digital Services Platform                                                    *
+ * Copyright (c) 2026 - All rights reserved.                                    *
+ *                                                                              *
+ * No part of this document may be reproduced in any form without the           *
+ * express written consent of Schneider-Electric.                               *
+ ********************************************************************************/
+
+/**
+ * @file
+ * Build time settings of the DTSE benchmark.<br>
+ * The enumerations used by the time series API (TS_valueType, DTSE_operator, TS_aggregatedVal,
+ * TS_ValueItem) and the release functions of the results are defined by timeSeries_Manager.h,
+ * which is delivered with the DTSE drop. The macros below map the benchmark on them and
+ * must be set from the compiler command line (-D...), see BENCH_DEFS in the Makefile.
+ */
+
+#ifndef BENCH_CONFIG_H_
+#define BENCH_CONFIG_H_
+
+/**
+ * Header declaring DTSE_Init(), DTSE_Query() and DTSE_DeleteQueryResult().
+ * When not defined, the parse-to-result benchmark is not compiled and the benchmark
+ * only exercises the time series API and the mocked DMAPI.
+ * Example : -DBENCH_DTSE_HEADER='"DTSE.h"'
+ */
+/* #define BENCH_DTSE_HEADER "DTSE.h" */
+
+#ifndef BENCH_DTSE_INIT
+#define BENCH_DTSE_INIT()				DTSE_Init()		/**<  Initializes the DTSE, calls DM_Open() */
+#endif
+
+#ifndef BENCH_DTSE_CLOSE
+#define BENCH_DTSE_CLOSE()				DTSE_Close()	/**<  Releases the DTSE, calls DM_Close() */
+#endif
+
+#ifndef BENCH_TS_NEXT_VALUE
+#define BENCH_TS_NEXT_VALUE(value)		((value)->next)	/**<  Next element of a s_TS_Value list */
+#endif
+
+/*
+ * The following settings have no default : their values depend on the DTSE drop.
+ * Example : -DBENCH_TS_VALUE_TYPE=TS_DOUBLE -DBENCH_TS_FREE_VALUES=TS_FreeValues ...
+ */
+
+#ifndef BENCH_TS_VALUE_TYPE
+#error "BENCH_TS_VALUE_TYPE must be set to the TS_valueType of the benchmarked series (double)"
+#endif
+
+#ifndef BENCH_TS_OPERATOR
+#error "BENCH_TS_OPERATOR must be set to the DTSE_operator used by TS_Select (eg. greater than)"
+#endif
+
+#ifndef BENCH_TS_AGGREGATION
+#error "BENCH_TS_AGGREGATION must be set to the TS_aggregatedVal used by DTSE_TS_aggregate (eg. average)"
+#endif
+
+#ifndef BENCH_TS_GROUP_BY
+#error "BENCH_TS_GROUP_BY must be set to the TS_ValueItem used by DTSE_TS_aggregate (eg. day)"
+#endif
+
+#ifndef BENCH_TS_FREE_VALUES
+#error "BENCH_TS_FREE_VALUES must be set to the function releasing a s_TS_Value list"
+#endif
+
+#ifndef BENCH_TS_FREE_RANGES
+#error "BENCH_TS_FREE_RANGES must be set to the function releasing a s_TS_TimeRange list"
+#endif
+
+#endif /* BENCH_CONFIG_H_ */
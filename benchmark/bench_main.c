@@ -0,0 +1,551 @@
+/********************************************************************************
+ * Schneider-Electric                                                           *
+ * Global Solutions - Digital Services Transformation                           *
+ * Digital Services Platform                                                    *
+ * Copyright (c) 2026 - All rights reserved.                                    *
+ *                                                                              *
+ * No part of this document may be reproduced in any form without the           *
+ * express written consent of Schneider-Electric.                               *
+ ********************************************************************************/
+
+/**
+ * @file
+ * DTSE benchmark driver.<br>
+ * Runs the DTSE against the in-memory DMAPI (dmapi_mock.h) and synthetic time series
+ * (ts_workload.h), then writes one JSON object per line on the output :
+ *  - "ingest"  : TS_Insert throughput
+ *  - "latency" : TS_Select, DTSE_TS_aggregate and DTSE_TS_SelectTimes latency percentiles
+ *  - "query"   : parse-to-result latency percentiles of representative grammar queries
+ *  - "dmapi"   : number of calls received by the mocked DMAPI
+ *  - "stats"   : DTSE instrumentation (DTSE_stats.h), when built with DTSE_ENABLE_STATS
+ *  - "memory"  : peak resident set size
+ *
+ * Usage : dtse_bench [--devices N] [--variables M] [--tag-instances K] [--tag-skew S]
+ *                    [--series N] [--points N] [--iterations N] [--churn-every N]
+ *                    [--trace-threshold-us N] [--seed N] [--output file]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#include "bench_config.h"
+#include "dmapi_mock.h"
+#include "ts_workload.h"
+#include "bench_random.h"
+#include "TS_api.h"
+#include "DTSE_stats.h"
+#ifdef BENCH_DTSE_HEADER
+#include BENCH_DTSE_HEADER
+#endif
+
+#define BENCH_TS_ID_SIZE		80
+#define BENCH_SELECT_LAST_N		100
+#define BENCH_QUERY_FAILED		(-1)
+
+/*=============================================================================
+                              Structures
+==============================================================================*/
+
+typedef struct
+{
+	s_DM_MockConfig		model;
+	DTSE_int			nbSeries;		/* 0 : one series per variable */
+	DTSE_int			nbPoints;		/* points per series */
+	DTSE_int			iterations;		/* samples per latency measure */
+	DTSE_int			churnEvery;		/* 0 : no data model change */
+	unsigned long long	traceThresholdUs;	/* 0 : no query trace */
+	FILE *				output;
+} s_BenchOptions;
+
+typedef struct
+{
+	char				id[BENCH_TS_ID_SIZE];
+	s_TS_Generator		generator;
+} s_BenchSeries;
+
+/*=============================================================================
+                              Globals
+==============================================================================*/
+
+#ifdef BENCH_DTSE_HEADER
+/** Representative queries of the grammar, on the tags published by the mock */
+static const char * bench_queries[] = {
+	"Search Variable usage:Temperature",
+	"Search Device location:Site0 and protocol:Bus1",
+	"Search Variable usage:Power with unit == \"W\"",
+	"Avg Variable usage:Temperature with value > 20",
+	"Search Values usage:Temperature where value > 20 when hours >= 8 and hours < 18",
+	"Avg Values usage:Power where value > 1000 from 2019-01-01 to 2019-01-31 group by day",
+	"Search Times usage:Temperature where value > 25 during time > 00:30:00",
+	NULL
+};
+#endif
+
+static const double bench_percentiles[] = { 50.0, 90.0, 99.0, 99.9 };
+static const char * bench_percentilesNames[] = { "p50_us", "p90_us", "p99_us", "p999_us" };
+
+/*=============================================================================
+                              Local functions
+==============================================================================*/
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static int bench_compare(const void * a, const void * b)
+{
+	double x = *(const double *) a, y = *(const double *) b;
+	return (x > y) - (x < y);
+}
+
+static void bench_jsonString(FILE * out, const char * s)
+{
+	fputc('"', out);
+	for (; *s != '\0'; s++)
+	{
+		if (*s == '"' || *s == '\\')
+			fputc('\\', out);
+		fputc(*s, out);
+	}
+	fputc('"', out);
+}
+
+/* Sorts the samples (micro seconds) of the successful calls and writes the percentiles */
+static void bench_reportLatency(FILE * out, const char * kind, const char * name, double * samples, DTSE_int n,
+		DTSE_int failed)
+{
+	double sum = 0;
+	size_t i;
+	DTSE_int k;
+
+	fprintf(out, "{\"bench\":\"%s\",\"name\":", kind);
+	bench_jsonString(out, name);
+	fprintf(out, ",\"samples\":%d,\"failed\":%d", (int) n, (int) failed);
+	if (n <= 0)
+	{
+		fprintf(out, "}\n");
+		return;
+	}
+
+	qsort(samples, n, sizeof(double), bench_compare);
+	for (k = 0; k < n; k++)
+		sum += samples[k];
+
+	fprintf(out, ",\"mean_us\":%.3f,\"min_us\":%.3f", sum / n, samples[0]);
+	for (i = 0; i < sizeof(bench_percentiles) / sizeof(bench_percentiles[0]); i++)
+	{
+		/* nearest rank */
+		DTSE_int rank = (DTSE_int)(bench_percentiles[i] / 100.0 * n + 0.999999);
+		if (rank < 1)
+			rank = 1;
+		fprintf(out, ",\"%s\":%.3f", bench_percentilesNames[i], samples[rank - 1]);
+	}
+	fprintf(out, ",\"max_us\":%.3f}\n", samples[n - 1]);
+}
+
+static unsigned long long bench_rng = 1;
+
+static DTSE_int bench_randomIndex(DTSE_int n)
+{
+	return (DTSE_int)((Bench_RandomNext(&bench_rng) >> 33) % (unsigned long long) n);
+}
+
+#ifdef DTSE_ENABLE_STATS
+static unsigned long long bench_countValues(s_TS_Value * values)
+{
+	unsigned long long count = 0;
+
+	for (; values != NULL; values = BENCH_TS_NEXT_VALUE(values))
+		count++;
+	return count;
+}
+#endif
+
+static int bench_parseOptions(int argc, char ** argv, s_BenchOptions * options)
+{
+	int i;
+
+	DM_Mock_DefaultConfig(&options->model);
+	options->nbSeries   = 0;
+	options->nbPoints   = 10000;
+	options->iterations = 1000;
+	options->churnEvery = 50;
+	options->traceThresholdUs = 0;
+	options->output     = stdout;
+
+	for (i = 1; i < argc; i++)
+	{
+		const char * value = i + 1 < argc ? argv[i + 1] : NULL;
+
+		if (value == NULL)
+			return -1;
+		if (strcmp(argv[i], "--devices") == 0)
+			options->model.nbDevices = atoi(value);
+		else if (strcmp(argv[i], "--variables") == 0)
+			options->model.nbVariablesPerDevice = atoi(value);
+		else if (strcmp(argv[i], "--tag-instances") == 0)
+			options->model.nbTagInstances = atoi(value);
+		else if (strcmp(argv[i], "--tag-skew") == 0)
+			options->model.tagSkew = atof(value);
+		else if (strcmp(argv[i], "--seed") == 0)
+			options->model.seed = (unsigned int) strtoul(value, NULL, 10);
+		else if (strcmp(argv[i], "--series") == 0)
+			options->nbSeries = atoi(value);
+		else if (strcmp(argv[i], "--points") == 0)
+			options->nbPoints = atoi(value);
+		else if (strcmp(argv[i], "--iterations") == 0)
+			options->iterations = atoi(value);
+		else if (strcmp(argv[i], "--churn-every") == 0)
+			options->churnEvery = atoi(value);
+		else if (strcmp(argv[i], "--trace-threshold-us") == 0)
+			options->traceThresholdUs = strtoull(value, NULL, 10);
+		else if (strcmp(argv[i], "--output") == 0)
+		{
+			if ((options->output = fopen(value, "w")) == NULL)
+				return -1;
+		}
+		else
+			return -1;
+		i++;
+	}
+
+	if (options->nbPoints <= 0 || options->iterations <= 0 || options->churnEvery < 0)
+		return -1;
+	return 0;
+}
+
+/* Creates the series, one per mocked variable, and their generators */
+static s_BenchSeries * bench_createSeries(const s_BenchOptions * options, DTSE_int * nbSeries)
+{
+	static const double bases[] = { 21.0, 45.0, 1500.0, 230.0, 6.5, 12000.0, 101325.0, 600.0 };
+	DTSE_int total = options->model.nbDevices * options->model.nbVariablesPerDevice;
+	s_BenchSeries * series;
+	DTSE_int s;
+
+	if (options->nbSeries > 0 && options->nbSeries < total)
+		total = options->nbSeries;
+
+	series = calloc(total, sizeof(s_BenchSeries));
+	if (series == NULL)
+		return NULL;
+
+	for (s = 0; s < total; s++)
+	{
+		DTSE_int variable = s % options->model.nbVariablesPerDevice;
+		s_TS_WorkloadConfig config;
+		char * deviceId, * variableId;
+
+		if (DM_Mock_GetIds(s / options->model.nbVariablesPerDevice, variable, &deviceId, &variableId) != DTSE_SUCCESS)
+		{
+			free(series);
+			return NULL;
+		}
+		snprintf(series[s].id, BENCH_TS_ID_SIZE, "%s/%s", deviceId, variableId);
+		if (TS_NewTimeSeries(series[s].id, BENCH_TS_VALUE_TYPE) != DTSE_SUCCESS)
+		{
+			free(series);
+			return NULL;
+		}
+
+		/* same mapping as the "usage" tags of the mock */
+		TS_Workload_DefaultConfig(&config, bases[variable % 8]);
+		TS_Workload_Init(&series[s].generator, &config, options->model.seed * 7919u + (unsigned int) s);
+	}
+
+	*nbSeries = total;
+	return series;
+}
+
+/*
+ * Inserts the points in arrival order (round robin between series). The points of a round
+ * are generated before it starts, so that only the TS_Insert calls are timed.
+ */
+static void bench_ingest(const s_BenchOptions * options, s_BenchSeries * series, DTSE_int nbSeries)
+{
+	DTSE_time * times    = malloc(nbSeries * sizeof(DTSE_time));
+	DTSE_double * values = malloc(nbSeries * sizeof(DTSE_double));
+	unsigned long long inserted = 0, failed = 0;
+	double start, roundElapsed, elapsed = 0;
+	DTSE_int p, s;
+
+	if (times == NULL || values == NULL)
+	{
+		free(times);
+		free(values);
+		return;
+	}
+
+	for (p = 0; p < options->nbPoints; p++)
+	{
+		unsigned long long roundInserted = 0;
+
+		for (s = 0; s < nbSeries; s++)
+			TS_Workload_Next(&series[s].generator, &times[s], &values[s]);
+
+		start = bench_now();
+		for (s = 0; s < nbSeries; s++)
+		{
+			if (TS_Insert(series[s].id, times[s], values[s]) == DTSE_SUCCESS)
+				roundInserted++;
+			else
+				failed++;
+		}
+		roundElapsed = bench_now() - start;
+		elapsed += roundElapsed;
+
+		/* one timer per round of inserts, a timer per point would cost more than the insert */
+		DTSE_STATS_RECORD(DTSE_STATS_STAGE_TS_INSERT, (unsigned long long)(roundElapsed * 1e3));
+		DTSE_STATS_ADD(DTSE_STATS_POINTS_INGESTED, roundInserted);
+		inserted += roundInserted;
+	}
+
+	fprintf(options->output,
+			"{\"bench\":\"ingest\",\"series\":%d,\"points\":%llu,\"failed\":%llu,\"seconds\":%.6f,\"points_per_sec\":%.1f}\n",
+			(int) nbSeries, inserted, failed, elapsed / 1e6, elapsed > 0 ? inserted / (elapsed / 1e6) : 0.0);
+
+	free(times);
+	free(values);
+}
+
+static void bench_timeSeriesLatency(const s_BenchOptions * options, s_BenchSeries * series, DTSE_int nbSeries)
+{
+	double * select    = malloc(options->iterations * sizeof(double));
+	double * aggregate = malloc(options->iterations * sizeof(double));
+	double * times     = malloc(options->iterations * sizeof(double));
+	DTSE_int nbSelect = 0, nbAggregate = 0, nbTimes = 0, i;
+
+	if (select == NULL || aggregate == NULL || times == NULL)
+	{
+		free(select);
+		free(aggregate);
+		free(times);
+		return;
+	}
+
+	/*
+	 * failed calls are counted apart, they would distort the latencies.
+	 * Only the call is timed : its duration is recorded in the ts_scan timer and the returned
+	 * points are counted outside the measure, so both binaries report the same latencies.
+	 */
+	for (i = 0; i < options->iterations; i++)
+	{
+		char * id = series[bench_randomIndex(nbSeries)].id;
+		DTSE_STATUS status;
+		s_TS_Value * values;
+		s_TS_TimeRange * ranges;
+		double start, elapsed;
+
+		DTSE_STATS_QUERY_BEGIN("TS_Select");
+		start = bench_now();
+		values = TS_Select(id, BENCH_SELECT_LAST_N, BENCH_TS_OPERATOR, 0.0, &status);
+		elapsed = bench_now() - start;
+		DTSE_STATS_RECORD(DTSE_STATS_STAGE_TS_SCAN, (unsigned long long)(elapsed * 1e3));
+		DTSE_STATS_ADD(DTSE_STATS_POINTS_RETURNED, bench_countValues(values));
+		DTSE_STATS_QUERY_END(status);
+		if (status == DTSE_SUCCESS)
+			select[nbSelect++] = elapsed;
+		if (values != NULL)
+			BENCH_TS_FREE_VALUES(values);
+
+		DTSE_STATS_QUERY_BEGIN("DTSE_TS_aggregate");
+		start = bench_now();
+		values = DTSE_TS_aggregate(id, BENCH_TS_AGGREGATION, NULL, NULL, NULL, BENCH_TS_GROUP_BY, &status);
+		elapsed = bench_now() - start;
+		DTSE_STATS_RECORD(DTSE_STATS_STAGE_TS_SCAN, (unsigned long long)(elapsed * 1e3));
+		DTSE_STATS_ADD(DTSE_STATS_POINTS_RETURNED, bench_countValues(values));
+		DTSE_STATS_QUERY_END(status);
+		if (status == DTSE_SUCCESS)
+			aggregate[nbAggregate++] = elapsed;
+		if (values != NULL)
+			BENCH_TS_FREE_VALUES(values);
+
+		DTSE_STATS_QUERY_BEGIN("DTSE_TS_SelectTimes");
+		start = bench_now();
+		ranges = DTSE_TS_SelectTimes(id, NULL, NULL, NULL, NULL, &status);
+		elapsed = bench_now() - start;
+		DTSE_STATS_RECORD(DTSE_STATS_STAGE_TS_SCAN, (unsigned long long)(elapsed * 1e3));
+		DTSE_STATS_QUERY_END(status);
+		if (status == DTSE_SUCCESS)
+			times[nbTimes++] = elapsed;
+		if (ranges != NULL)
+			BENCH_TS_FREE_RANGES(ranges);
+
+		if (options->churnEvery > 0 && i % options->churnEvery == 0)
+			DM_Mock_Churn(1);
+	}
+
+	bench_reportLatency(options->output, "latency", "TS_Select", select, nbSelect,
+			options->iterations - nbSelect);
+	bench_reportLatency(options->output, "latency", "DTSE_TS_aggregate", aggregate, nbAggregate,
+			options->iterations - nbAggregate);
+	bench_reportLatency(options->output, "latency", "DTSE_TS_SelectTimes", times, nbTimes,
+			options->iterations - nbTimes);
+
+	free(select);
+	free(aggregate);
+	free(times);
+}
+
+#ifdef BENCH_DTSE_HEADER
+static void bench_queryLatency(const s_BenchOptions * options)
+{
+	double * samples = malloc(options->iterations * sizeof(double));
+	DTSE_int q, i;
+
+	if (samples == NULL)
+		return;
+
+	for (q = 0; bench_queries[q] != NULL; q++)
+	{
+		DTSE_int nbSamples = 0;
+
+		for (i = 0; i < options->iterations; i++)
+		{
+			DTSE_QueryResult * results;
+			double start, elapsed;
+
+			/* a NULL result is a parse or engine error, counted apart like the failed TS calls */
+			DTSE_STATS_QUERY_BEGIN(bench_queries[q]);
+			start = bench_now();
+			results = DTSE_Query((char *) bench_queries[q]);
+			elapsed = bench_now() - start;
+			DTSE_STATS_QUERY_END(results != NULL ? DTSE_SUCCESS : BENCH_QUERY_FAILED);
+			if (results != NULL)
+			{
+				samples[nbSamples++] = elapsed;
+				DTSE_DeleteQueryResult(results);
+			}
+
+			if (options->churnEvery > 0 && i % options->churnEvery == 0)
+				DM_Mock_Churn(1);
+		}
+		bench_reportLatency(options->output, "query", bench_queries[q], samples, nbSamples,
+				options->iterations - nbSamples);
+	}
+	free(samples);
+}
+#endif
+
+static void bench_reportDmapi(FILE * out)
+{
+	s_DM_MockCounters counters;
+
+	DM_Mock_GetCounters(&counters);
+	fprintf(out,
+			"{\"bench\":\"dmapi\",\"get_device\":%lu,\"get_variable\":%lu,\"get_variable_value\":%lu,"
+			"\"get_devices_by_tags\":%lu,\"get_variables_by_tags\":%lu,\"free_node\":%lu,"
+			"\"sessions\":%lu,\"churn_changes\":%lu,\"notifications\":%lu}\n",
+			counters.getDevice, counters.getVariable, counters.getVariableValue,
+			counters.getDevicesByTags, counters.getVariablesByTags, counters.freeNode,
+			counters.sessions, counters.changes, counters.notifications);
+}
+
+static void bench_reportStats(FILE * out)
+{
+	s_Stats stats;
+	DTSE_int t, c;
+
+	if (DTSE_Stats_Get(&stats) != DTSE_SUCCESS)
+		return;
+
+	for (t = 0; t < DTSE_STATS_NB_TIMERS; t++)
+	{
+		const s_TimerStats * timer = &stats.timers[t];
+
+		if (timer->calls == 0)
+			continue;
+		fprintf(out, "{\"bench\":\"stats\",\"name\":\"%s\",\"calls\":%llu,\"mean_us\":%.3f,"
+				"\"p50_us\":%.3f,\"p99_us\":%.3f,\"max_us\":%.3f}\n",
+				DTSE_Stats_TimerName((stats_timer) t), timer->calls, timer->totalNs / 1e3 / timer->calls,
+				DTSE_Stats_Percentile(timer, 50.0) / 1e3, DTSE_Stats_Percentile(timer, 99.0) / 1e3,
+				timer->maxNs / 1e3);
+	}
+
+	fprintf(out, "{\"bench\":\"stats\",\"threads\":%d", (int) stats.threads);
+	for (c = 0; c < DTSE_STATS_NB_COUNTERS; c++)
+		fprintf(out, ",\"%s\":%llu", DTSE_Stats_CounterName((stats_counter) c), stats.counters[c]);
+	fprintf(out, "}\n");
+}
+
+static void bench_reportMemory(FILE * out)
+{
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return;
+	/* ru_maxrss is in kilobytes on Linux */
+	fprintf(out, "{\"bench\":\"memory\",\"peak_rss_kb\":%ld}\n", usage.ru_maxrss);
+}
+
+/*=============================================================================
+                              Entry point
+==============================================================================*/
+
+int main(int argc, char ** argv)
+{
+	s_BenchOptions options;
+	s_BenchSeries * series;
+	DTSE_int nbSeries = 0;
+
+	if (bench_parseOptions(argc, argv, &options) != 0)
+	{
+		fprintf(stderr, "Usage: %s [--devices N] [--variables M] [--tag-instances K] [--tag-skew S]"
+				" [--series N] [--points N] [--iterations N] [--churn-every N] [--trace-threshold-us N]"
+				" [--seed N] [--output file]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	bench_rng = 0x9E3779B97F4A7C15ULL ^ options.model.seed;
+	DTSE_Stats_SetTrace(options.traceThresholdUs, NULL);
+
+	if (DM_Mock_Configure(&options.model) != DTSE_SUCCESS)
+	{
+		fprintf(stderr, "Invalid data model configuration\n");
+		return EXIT_FAILURE;
+	}
+
+#ifdef BENCH_DTSE_HEADER
+	if (BENCH_DTSE_INIT() != DTSE_SUCCESS)
+#else
+	if (DM_Open() != DTSE_SUCCESS)
+#endif
+	{
+		fprintf(stderr, "Initialization failed\n");
+		return EXIT_FAILURE;
+	}
+
+	if (TS_init() != DTSE_SUCCESS || (series = bench_createSeries(&options, &nbSeries)) == NULL)
+	{
+		fprintf(stderr, "Time series initialization failed\n");
+		return EXIT_FAILURE;
+	}
+
+	bench_ingest(&options, series, nbSeries);
+	bench_timeSeriesLatency(&options, series, nbSeries);
+#ifdef BENCH_DTSE_HEADER
+	bench_queryLatency(&options);
+#endif
+	bench_reportDmapi(options.output);
+	bench_reportStats(options.output);
+	bench_reportMemory(options.output);
+
+	free(series);
+	TS_Close();
+#ifdef BENCH_DTSE_HEADER
+	BENCH_DTSE_CLOSE();
+#else
+	DM_Close();
+#endif
+
+	if (options.output != stdout)
+		fclose(options.output);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,52 @@
+/********************************************************************************
+ * Schneider-Electric                                                           *
+ * Global Solutions - Digital Services Transformation                           *
+ * Digital Services Platform                                                    *
+ * Copyright (c) 2026 - All rights reserved.                                    *
+ *                                                                              *
+ * No part of this document may be reproduced in any form without the           *
+ * express written consent of Schneider-Electric.                               *
+ ********************************************************************************/
+
+/**
+ * @file
+ * Pseudo random generator shared by the DTSE benchmark modules.<br>
+ * xorshift64* is used instead of rand() so that a given seed produces the same data
+ * model and the same time series on every platform.
+ */
+
+#ifndef BENCH_RANDOM_H_
+#define BENCH_RANDOM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns the next 64 bits value of a xorshift64* generator.
+ *
+ * @param[in,out] state : Non NULL pointer on the state of the generator, must not be 0
+ */
+static inline unsigned long long Bench_RandomNext(unsigned long long * state)
+{
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 2685821657736338717ULL;
+}
+
+/**
+ * Returns a value uniformly distributed in [0, 1[.
+ *
+ * @param[in,out] state : Non NULL pointer on the state of the generator, must not be 0
+ */
+static inline double Bench_RandomUniform(unsigned long long * state)
+{
+	return (double)(Bench_RandomNext(state) >> 11) / 9007199254740992.0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_RANDOM_H_ */
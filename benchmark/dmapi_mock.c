@@ -0,0 +1,858 @@
+/********************************************************************************
+ * Schneider-Electric                                                           *
+ * Global Solutions - Digital Services Transformation                           *
+ * Digital Services Platform                                                    *
+ * Copyright (c) 2026 - All rights reserved.                                    *
+ *                                                                              *
+ * No part of this document may be reproduced in any form without the           *
+ * express written consent of Schneider-Electric.                               *
+ ********************************************************************************/
+
+/**
+ * @file
+ * In-memory DMAPI implementation used by the DTSE benchmark, see dmapi_mock.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "dmapi_mock.h"
+#include "bench_random.h"
+#include "DTSE_stats.h"
+
+/*=============================================================================
+                              Defines
+==============================================================================*/
+
+#define DM_MOCK_ERROR				(-1)	/**<  Generic error returned by the mock */
+#define DM_MOCK_NB_NAMESPACES		3		/**<  Number of tag namespaces attached to devices */
+#define DM_MOCK_NB_USAGES			8		/**<  Number of "usage" instances attached to variables */
+#define DM_MOCK_ID_SIZE				32		/**<  Size of the generated identifiers */
+
+/*=============================================================================
+                              Structures
+==============================================================================*/
+
+typedef struct
+{
+	char			id[DM_MOCK_ID_SIZE];
+	char			name[DM_MOCK_ID_SIZE];
+	DTSE_int		tags[DM_MOCK_NB_NAMESPACES];	/* instance index for each namespace */
+} s_MockDevice;
+
+typedef struct
+{
+	char			id[DM_MOCK_ID_SIZE];
+	DTSE_int		usage;							/* index in mock_usages */
+	float			value;
+} s_MockVariable;
+
+typedef struct
+{
+	DTSE_int		device;
+	DTSE_int		variable;						/* -1 for a device subscription */
+	void 			(*pfn)(char * deviceID, char *variableID);
+} s_MockSubscription;
+
+/*=============================================================================
+                              Globals
+==============================================================================*/
+
+static const char * mock_namespaces[DM_MOCK_NB_NAMESPACES] = { "location", "protocol", "floor" };
+static const char * mock_instancesPrefix[DM_MOCK_NB_NAMESPACES] = { "Site", "Bus", "Floor" };
+
+static const char * mock_usages[DM_MOCK_NB_USAGES] = {
+		"Temperature", "Humidity", "Power", "Voltage", "Current", "Energy", "Pressure", "CO2" };
+static const char * mock_units[DM_MOCK_NB_USAGES] = {
+		"C", "%", "W", "V", "A", "Wh", "Pa", "ppm" };
+static const float  mock_baseValues[DM_MOCK_NB_USAGES] = {
+		21.0f, 45.0f, 1500.0f, 230.0f, 6.5f, 12000.0f, 101325.0f, 600.0f };
+
+static s_DM_MockConfig		mock_config;
+static int					mock_configured = 0;
+static int					mock_opened = 0;
+static pthread_mutex_t		mock_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static s_MockDevice *		mock_devices = NULL;
+static s_MockVariable *		mock_variables = NULL;		/* nbDevices * nbVariablesPerDevice entries */
+static double *				mock_zipfCdf = NULL;		/* nbTagInstances entries */
+static unsigned long long	mock_rngState = 1;
+
+static s_MockSubscription *	mock_subscriptions = NULL;	/* one per device and per variable */
+static DTSE_int				mock_maxSubscriptions = 0;
+static DTSE_int				mock_nbSubscriptions = 0;
+
+static DTSE_int				mock_nextSession = 0;
+static s_DM_MockCounters	mock_counters;
+
+/*=============================================================================
+                              Local functions
+==============================================================================*/
+
+static DTSE_int mock_zipf(void)
+{
+	double u = Bench_RandomUniform(&mock_rngState);
+	DTSE_int lo = 0, hi = mock_config.nbTagInstances - 1;
+
+	while (lo < hi)
+	{
+		DTSE_int mid = (lo + hi) / 2;
+		if (mock_zipfCdf[mid] < u)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+static char * mock_strdup(const char * s)
+{
+	size_t len;
+	char * copy;
+
+	if (s == NULL)
+		return NULL;
+	len = strlen(s) + 1;
+	copy = malloc(len);
+	if (copy != NULL)
+		memcpy(copy, s, len);
+	return copy;
+}
+
+static char * mock_instanceName(DTSE_int ns, DTSE_int instance)
+{
+	char buffer[DM_MOCK_ID_SIZE];
+
+	snprintf(buffer, sizeof(buffer), "%s%d", mock_instancesPrefix[ns], (int) instance);
+	return mock_strdup(buffer);
+}
+
+/* Returns the device index from its identifier "dev_<index>", or -1 */
+static DTSE_int mock_deviceIndex(const char * id)
+{
+	char * end;
+	long index;
+
+	if (id == NULL || strncmp(id, "dev_", 4) != 0)
+		return -1;
+	index = strtol(id + 4, &end, 10);
+	if (*end != '\0' || index < 0 || index >= mock_config.nbDevices)
+		return -1;
+	return (DTSE_int) index;
+}
+
+/* Returns the variable index from its identifier "var_<index>", or -1 */
+static DTSE_int mock_variableIndex(const char * id)
+{
+	char * end;
+	long index;
+
+	if (id == NULL || strncmp(id, "var_", 4) != 0)
+		return -1;
+	index = strtol(id + 4, &end, 10);
+	if (*end != '\0' || index < 0 || index >= mock_config.nbVariablesPerDevice)
+		return -1;
+	return (DTSE_int) index;
+}
+
+static s_MockVariable * mock_findVariable(const char * deviceId, const char * variableId)
+{
+	DTSE_int d = mock_deviceIndex(deviceId);
+	DTSE_int v = mock_variableIndex(variableId);
+
+	if (d < 0 || v < 0)
+		return NULL;
+	return &mock_variables[d * mock_config.nbVariablesPerDevice + v];
+}
+
+static s_Tag * mock_newTag(const char * Namespace, char * instance)
+{
+	s_Tag * tag = malloc(sizeof(s_Tag));
+
+	if (tag == NULL)
+	{
+		free(instance);
+		return NULL;
+	}
+	tag->Namespace = mock_strdup(Namespace);
+	tag->instance  = instance;
+	tag->next      = NULL;
+	return tag;
+}
+
+static s_Tag * mock_copyDeviceTags(const s_MockDevice * device)
+{
+	s_Tag * head = NULL;
+	DTSE_int ns;
+
+	for (ns = DM_MOCK_NB_NAMESPACES - 1; ns >= 0; ns--)
+	{
+		s_Tag * tag = mock_newTag(mock_namespaces[ns], mock_instanceName(ns, device->tags[ns]));
+		if (tag == NULL)
+			break;
+		tag->next = head;
+		head = tag;
+	}
+	return head;
+}
+
+static s_NodeId * mock_copyVariablesIds(DTSE_int d)
+{
+	s_NodeId * head = NULL;
+	DTSE_int v;
+
+	for (v = mock_config.nbVariablesPerDevice - 1; v >= 0; v--)
+	{
+		s_NodeId * node = malloc(sizeof(s_NodeId));
+		if (node == NULL)
+			break;
+		node->id   = mock_strdup(mock_variables[d * mock_config.nbVariablesPerDevice + v].id);
+		node->next = head;
+		head = node;
+	}
+	return head;
+}
+
+static s_Device * mock_copyDevice(DTSE_int d)
+{
+	s_Device * device = malloc(sizeof(s_Device));
+
+	if (device == NULL)
+		return NULL;
+	device->id        = mock_strdup(mock_devices[d].id);
+	device->name      = mock_strdup(mock_devices[d].name);
+	device->parentId  = NULL;
+	device->tags      = mock_copyDeviceTags(&mock_devices[d]);
+	device->variables = mock_copyVariablesIds(d);
+	device->children  = NULL;
+	device->next      = NULL;
+	return device;
+}
+
+static s_Variable * mock_copyVariable(DTSE_int d, DTSE_int v)
+{
+	const s_MockVariable * src = &mock_variables[d * mock_config.nbVariablesPerDevice + v];
+	s_Variable * variable = malloc(sizeof(s_Variable));
+	float * value;
+
+	if (variable == NULL)
+		return NULL;
+	value = malloc(sizeof(float));
+	if (value != NULL)
+		*value = src->value;
+	variable->id              = mock_strdup(src->id);
+	variable->name            = mock_strdup(mock_usages[src->usage]);
+	variable->unit            = mock_strdup(mock_units[src->usage]);
+	variable->parent_deviceId = mock_strdup(mock_devices[d].id);
+	variable->tags            = mock_newTag("usage", mock_strdup(mock_usages[src->usage]));
+	variable->type            = TYPE_FLOAT;
+	variable->value           = value;
+	variable->size            = sizeof(float);
+	variable->next            = NULL;
+	return variable;
+}
+
+/*
+ * Resolves a list of tags to (namespace, instance) indexes.
+ * For the "usage" namespace, the returned namespace index is DM_MOCK_NB_NAMESPACES.
+ * Returns the number of resolved tags, unknown tags are ignored.
+ */
+static DTSE_int mock_resolveTags(s_Tag * listOfTags, DTSE_int * namespaces, DTSE_int * instances, DTSE_int max)
+{
+	DTSE_int count = 0;
+	s_Tag * tag;
+
+	for (tag = listOfTags; tag != NULL && count < max; tag = tag->next)
+	{
+		DTSE_int ns, k;
+
+		if (tag->Namespace == NULL || tag->instance == NULL)
+			continue;
+
+		if (strcmp(tag->Namespace, "usage") == 0)
+		{
+			for (k = 0; k < DM_MOCK_NB_USAGES; k++)
+			{
+				if (strcmp(tag->instance, mock_usages[k]) == 0)
+				{
+					namespaces[count] = DM_MOCK_NB_NAMESPACES;
+					instances[count++] = k;
+					break;
+				}
+			}
+			continue;
+		}
+
+		for (ns = 0; ns < DM_MOCK_NB_NAMESPACES; ns++)
+		{
+			size_t prefixLen = strlen(mock_instancesPrefix[ns]);
+			char * end;
+			long instance;
+
+			if (strcmp(tag->Namespace, mock_namespaces[ns]) != 0)
+				continue;
+			if (strncmp(tag->instance, mock_instancesPrefix[ns], prefixLen) != 0)
+				break;
+			instance = strtol(tag->instance + prefixLen, &end, 10);
+			if (*end == '\0' && instance >= 0 && instance < mock_config.nbTagInstances)
+			{
+				namespaces[count] = ns;
+				instances[count++] = (DTSE_int) instance;
+			}
+			break;
+		}
+	}
+	return count;
+}
+
+static void mock_freeTags(s_Tag * tag, DTSE_int recursive)
+{
+	while (tag != NULL)
+	{
+		s_Tag * next = tag->next;
+		free(tag->Namespace);
+		free(tag->instance);
+		free(tag);
+		if (!recursive)
+			break;
+		tag = next;
+	}
+}
+
+static void mock_freeIds(s_NodeId * node, DTSE_int recursive)
+{
+	while (node != NULL)
+	{
+		s_NodeId * next = node->next;
+		free(node->id);
+		free(node);
+		if (!recursive)
+			break;
+		node = next;
+	}
+}
+
+static void mock_freeVariables(s_Variable * variable, DTSE_int recursive)
+{
+	while (variable != NULL)
+	{
+		s_Variable * next = variable->next;
+		free(variable->id);
+		free(variable->name);
+		free(variable->unit);
+		free(variable->parent_deviceId);
+		mock_freeTags(variable->tags, 1);
+		free(variable->value);
+		free(variable);
+		if (!recursive)
+			break;
+		variable = next;
+	}
+}
+
+static void mock_freeDevices(s_Device * device, DTSE_int recursive)
+{
+	while (device != NULL)
+	{
+		s_Device * next = device->next;
+		free(device->id);
+		free(device->name);
+		free(device->parentId);
+		mock_freeTags(device->tags, 1);
+		mock_freeIds(device->variables, 1);
+		mock_freeDevices(device->children, 1);
+		free(device);
+		if (!recursive)
+			break;
+		device = next;
+	}
+}
+
+/*=============================================================================
+                              Mock configuration
+==============================================================================*/
+
+void DM_Mock_DefaultConfig(s_DM_MockConfig * config)
+{
+	config->nbDevices            = 100;
+	config->nbVariablesPerDevice = 8;
+	config->nbTagInstances       = 16;
+	config->tagSkew              = 1.0;
+	config->seed                 = 1;
+}
+
+DTSE_STATUS DM_Mock_Configure(const s_DM_MockConfig * config)
+{
+	if (config == NULL || config->nbDevices <= 0 || config->nbVariablesPerDevice <= 0
+			|| config->nbTagInstances <= 0 || config->tagSkew < 0 || mock_opened)
+		return DM_MOCK_ERROR;
+
+	mock_config = *config;
+	mock_configured = 1;
+	return DTSE_SUCCESS;
+}
+
+DTSE_int DM_Mock_Churn(DTSE_int nbChanges)
+{
+	DTSE_int applied = 0;
+
+	while (applied < nbChanges)
+	{
+		void		(**pfn)(char * deviceID, char *variableID) = NULL;
+		char		deviceId[DM_MOCK_ID_SIZE];
+		DTSE_int	nbNotified = 0, d, ns, instance, k;
+
+		pthread_mutex_lock(&mock_lock);
+		if (!mock_opened || mock_config.nbTagInstances < 2)
+		{
+			pthread_mutex_unlock(&mock_lock);
+			break;
+		}
+
+		d  = (DTSE_int)(Bench_RandomUniform(&mock_rngState) * mock_config.nbDevices);
+		ns = (DTSE_int)(Bench_RandomUniform(&mock_rngState) * DM_MOCK_NB_NAMESPACES);
+		/* redraw so that the change is never a no-op, a high skew may need many draws */
+		for (k = 0; (instance = mock_zipf()) == mock_devices[d].tags[ns]; k++)
+		{
+			if (k == 64)
+			{
+				instance = (instance + 1) % mock_config.nbTagInstances;
+				break;
+			}
+		}
+		mock_devices[d].tags[ns] = instance;
+		mock_counters.changes++;
+
+		/* a device tag changed : its observers are notified with a NULL variable */
+		for (k = 0; k < mock_nbSubscriptions; k++)
+		{
+			if (mock_subscriptions[k].device != d)
+				continue;
+			if (pfn == NULL && (pfn = malloc(mock_nbSubscriptions * sizeof(*pfn))) == NULL)
+				break;
+			pfn[nbNotified++] = mock_subscriptions[k].pfn;
+		}
+		mock_counters.notifications += nbNotified;
+		memcpy(deviceId, mock_devices[d].id, DM_MOCK_ID_SIZE);
+		pthread_mutex_unlock(&mock_lock);
+
+		/* the call backs may call back into the DMAPI, so the lock is released */
+		for (k = 0; k < nbNotified; k++)
+			pfn[k](deviceId, NULL);
+		free(pfn);
+		applied++;
+	}
+	return applied;
+}
+
+DTSE_STATUS DM_Mock_GetIds(DTSE_int deviceIndex, DTSE_int variableIndex, char ** deviceId, char ** variableId)
+{
+	if (!mock_opened || deviceIndex < 0 || deviceIndex >= mock_config.nbDevices
+			|| variableIndex < 0 || variableIndex >= mock_config.nbVariablesPerDevice)
+		return DM_MOCK_ERROR;
+
+	*deviceId   = mock_devices[deviceIndex].id;
+	*variableId = mock_variables[deviceIndex * mock_config.nbVariablesPerDevice + variableIndex].id;
+	return DTSE_SUCCESS;
+}
+
+void DM_Mock_GetCounters(s_DM_MockCounters * counters)
+{
+	pthread_mutex_lock(&mock_lock);
+	*counters = mock_counters;
+	pthread_mutex_unlock(&mock_lock);
+}
+
+/*=============================================================================
+                              DMAPI implementation
+==============================================================================*/
+
+DTSE_STATUS DM_Open(void)
+{
+	DTSE_int d, v, k;
+	double sum = 0;
+
+	if (mock_opened)
+		return DM_MOCK_ERROR;
+	if (!mock_configured)
+		DM_Mock_DefaultConfig(&mock_config);
+
+	mock_devices   = calloc(mock_config.nbDevices, sizeof(s_MockDevice));
+	mock_variables = calloc((size_t) mock_config.nbDevices * mock_config.nbVariablesPerDevice, sizeof(s_MockVariable));
+	mock_zipfCdf   = calloc(mock_config.nbTagInstances, sizeof(double));
+	/* enough for a subscription on each device and on each variable */
+	mock_maxSubscriptions = mock_config.nbDevices * (mock_config.nbVariablesPerDevice + 1);
+	mock_subscriptions = calloc(mock_maxSubscriptions, sizeof(s_MockSubscription));
+	if (mock_devices == NULL || mock_variables == NULL || mock_zipfCdf == NULL || mock_subscriptions == NULL)
+	{
+		free(mock_devices);
+		free(mock_variables);
+		free(mock_zipfCdf);
+		free(mock_subscriptions);
+		mock_devices = NULL;
+		mock_variables = NULL;
+		mock_zipfCdf = NULL;
+		mock_subscriptions = NULL;
+		mock_maxSubscriptions = 0;
+		return DM_MOCK_ERROR;
+	}
+
+	for (k = 0; k < mock_config.nbTagInstances; k++)
+		mock_zipfCdf[k] = sum += 1.0 / pow(k + 1, mock_config.tagSkew);
+	for (k = 0; k < mock_config.nbTagInstances; k++)
+		mock_zipfCdf[k] /= sum;
+
+	mock_rngState = 0x9E3779B97F4A7C15ULL ^ mock_config.seed;
+
+	for (d = 0; d < mock_config.nbDevices; d++)
+	{
+		s_MockDevice * device = &mock_devices[d];
+
+		snprintf(device->id, DM_MOCK_ID_SIZE, "dev_%06d", (int) d);
+		snprintf(device->name, DM_MOCK_ID_SIZE, "Device %d", (int) d);
+		for (k = 0; k < DM_MOCK_NB_NAMESPACES; k++)
+			device->tags[k] = mock_zipf();
+
+		for (v = 0; v < mock_config.nbVariablesPerDevice; v++)
+		{
+			s_MockVariable * variable = &mock_variables[d * mock_config.nbVariablesPerDevice + v];
+
+			snprintf(variable->id, DM_MOCK_ID_SIZE, "var_%03d", (int) v);
+			variable->usage = v % DM_MOCK_NB_USAGES;
+			variable->value = mock_baseValues[variable->usage] * (float)(0.9 + 0.2 * Bench_RandomUniform(&mock_rngState));
+		}
+	}
+
+	memset(&mock_counters, 0, sizeof(mock_counters));
+	mock_nbSubscriptions = 0;
+	mock_nextSession = 0;
+	mock_opened = 1;
+	return DTSE_SUCCESS;
+}
+
+DTSE_STATUS DM_Close(void)
+{
+	pthread_mutex_lock(&mock_lock);
+	free(mock_devices);
+	free(mock_variables);
+	free(mock_zipfCdf);
+	free(mock_subscriptions);
+	mock_devices = NULL;
+	mock_variables = NULL;
+	mock_zipfCdf = NULL;
+	mock_subscriptions = NULL;
+	mock_maxSubscriptions = 0;
+	mock_nbSubscriptions = 0;
+	mock_opened = 0;
+	pthread_mutex_unlock(&mock_lock);
+	return DTSE_SUCCESS;
+}
+
+s_Device * DM_GetDevice(char *Id, DTSE_STATUS * Status)
+{
+	s_Device * device = NULL;
+	DTSE_int d;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getDevice++;
+	d = mock_deviceIndex(Id);
+	if (d >= 0)
+		device = mock_copyDevice(d);
+	pthread_mutex_unlock(&mock_lock);
+
+	*Status = device != NULL ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	DTSE_STATS_END(DTSE_STATS_DM_GET_DEVICE, start);
+	return device;
+}
+
+s_NodeId * DM_GetDeviceVariablesId(char *deviceId, DTSE_STATUS * Status)
+{
+	s_NodeId * ids = NULL;
+	DTSE_int d;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getDevice++;
+	d = mock_deviceIndex(deviceId);
+	if (d >= 0)
+		ids = mock_copyVariablesIds(d);
+	pthread_mutex_unlock(&mock_lock);
+
+	*Status = d >= 0 ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	DTSE_STATS_END(DTSE_STATS_DM_GET_DEVICE_VARIABLES_ID, start);
+	return ids;
+}
+
+s_Tag * DM_GetDeviceTags(char *deviceId, DTSE_STATUS * Status)
+{
+	s_Tag * tags = NULL;
+	DTSE_int d;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getDevice++;
+	d = mock_deviceIndex(deviceId);
+	if (d >= 0)
+		tags = mock_copyDeviceTags(&mock_devices[d]);
+	pthread_mutex_unlock(&mock_lock);
+
+	*Status = d >= 0 ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	DTSE_STATS_END(DTSE_STATS_DM_GET_DEVICE_TAGS, start);
+	return tags;
+}
+
+char * DM_GetDeviceParentId(char *deviceId, DTSE_STATUS * Status)
+{
+	/* the mocked data model is flat : all devices are root nodes */
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getDevice++;
+	*Status = mock_deviceIndex(deviceId) >= 0 ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	pthread_mutex_unlock(&mock_lock);
+	DTSE_STATS_END(DTSE_STATS_DM_GET_DEVICE_PARENT_ID, start);
+	return NULL;
+}
+
+s_NodeId * DM_GetDeviceChildrenId(char *deviceId, DTSE_STATUS * Status)
+{
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getDevice++;
+	*Status = mock_deviceIndex(deviceId) >= 0 ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	pthread_mutex_unlock(&mock_lock);
+	DTSE_STATS_END(DTSE_STATS_DM_GET_DEVICE_CHILDREN_ID, start);
+	return NULL;
+}
+
+s_Variable * DM_GetVariable(char *deviceId, char *variableId, DTSE_STATUS * Status)
+{
+	s_Variable * variable = NULL;
+	DTSE_int d, v;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getVariable++;
+	d = mock_deviceIndex(deviceId);
+	v = mock_variableIndex(variableId);
+	if (d >= 0 && v >= 0)
+		variable = mock_copyVariable(d, v);
+	pthread_mutex_unlock(&mock_lock);
+
+	*Status = variable != NULL ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	DTSE_STATS_END(DTSE_STATS_DM_GET_VARIABLE, start);
+	return variable;
+}
+
+variable_type DM_GetVariableType(char *deviceId, char *variableId, DTSE_STATUS * Status)
+{
+	s_MockVariable * variable;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getVariable++;
+	variable = mock_findVariable(deviceId, variableId);
+	pthread_mutex_unlock(&mock_lock);
+
+	*Status = variable != NULL ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	DTSE_STATS_END(DTSE_STATS_DM_GET_VARIABLE_TYPE, start);
+	return variable != NULL ? TYPE_FLOAT : TYPE_INVALID;
+}
+
+void * DM_GetVariableValue(char *deviceId, char *variableId, DTSE_STATUS * Status)
+{
+	s_MockVariable * variable;
+	float * value = NULL;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getVariableValue++;
+	variable = mock_findVariable(deviceId, variableId);
+	if (variable != NULL && (value = malloc(sizeof(float))) != NULL)
+		*value = variable->value;
+	pthread_mutex_unlock(&mock_lock);
+
+	*Status = value != NULL ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	DTSE_STATS_END(DTSE_STATS_DM_GET_VARIABLE_VALUE, start);
+	return value;
+}
+
+s_Tag * DM_GetVariableTags(char *deviceId, char *variableId, DTSE_STATUS * Status)
+{
+	s_MockVariable * variable;
+	s_Tag * tags = NULL;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getVariable++;
+	variable = mock_findVariable(deviceId, variableId);
+	if (variable != NULL)
+		tags = mock_newTag("usage", mock_strdup(mock_usages[variable->usage]));
+	pthread_mutex_unlock(&mock_lock);
+
+	*Status = variable != NULL ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	DTSE_STATS_END(DTSE_STATS_DM_GET_VARIABLE_TAGS, start);
+	return tags;
+}
+
+s_Device * DM_GetDevices_ByTags(s_Tag * listOfTags, DTSE_STATUS * Status)
+{
+	DTSE_int namespaces[64], instances[64];
+	DTSE_int nbTags, d, t;
+	s_Device * head = NULL, ** tail = &head;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getDevicesByTags++;
+	nbTags = mock_resolveTags(listOfTags, namespaces, instances, 64);
+
+	for (d = 0; d < mock_config.nbDevices; d++)
+	{
+		for (t = 0; t < nbTags; t++)
+		{
+			if (namespaces[t] < DM_MOCK_NB_NAMESPACES && mock_devices[d].tags[namespaces[t]] == instances[t])
+				break;
+		}
+		if (t < nbTags && (*tail = mock_copyDevice(d)) != NULL)
+			tail = &(*tail)->next;
+	}
+	pthread_mutex_unlock(&mock_lock);
+
+	*Status = DTSE_SUCCESS;
+	DTSE_STATS_END(DTSE_STATS_DM_GET_DEVICES_BY_TAGS, start);
+	return head;
+}
+
+s_Variable * DM_GetVariables_ByTags(s_Tag * listOfTags, DTSE_STATUS * Status)
+{
+	DTSE_int namespaces[64], instances[64];
+	DTSE_int nbTags, d, v, t;
+	s_Variable * head = NULL, ** tail = &head;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.getVariablesByTags++;
+	nbTags = mock_resolveTags(listOfTags, namespaces, instances, 64);
+
+	for (d = 0; d < mock_config.nbDevices; d++)
+	{
+		for (v = 0; v < mock_config.nbVariablesPerDevice; v++)
+		{
+			DTSE_int usage = mock_variables[d * mock_config.nbVariablesPerDevice + v].usage;
+
+			for (t = 0; t < nbTags; t++)
+			{
+				if (namespaces[t] == DM_MOCK_NB_NAMESPACES && instances[t] == usage)
+					break;
+			}
+			if (t < nbTags && (*tail = mock_copyVariable(d, v)) != NULL)
+				tail = &(*tail)->next;
+		}
+	}
+	pthread_mutex_unlock(&mock_lock);
+
+	*Status = DTSE_SUCCESS;
+	DTSE_STATS_END(DTSE_STATS_DM_GET_VARIABLES_BY_TAGS, start);
+	return head;
+}
+
+DTSE_STATUS DM_SetVariable(char *deviceId, char *variableId, void * value)
+{
+	s_MockVariable * variable = NULL;
+	DTSE_STATUS status;
+
+	DTSE_STATS_BEGIN(start);
+	if (value == NULL)
+		status = DM_MOCK_ERROR;
+	else
+	{
+		pthread_mutex_lock(&mock_lock);
+		variable = mock_findVariable(deviceId, variableId);
+		if (variable != NULL)
+			variable->value = *(float *) value;
+		pthread_mutex_unlock(&mock_lock);
+
+		free(value);
+		status = variable != NULL ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	}
+	DTSE_STATS_END(DTSE_STATS_DM_SET_VARIABLE, start);
+	return status;
+}
+
+DTSE_STATUS DM_FreeNode(node_type type, void * nodePtr, DTSE_int recursive)
+{
+	DTSE_STATUS status = DTSE_SUCCESS;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.freeNode++;
+	pthread_mutex_unlock(&mock_lock);
+
+	switch (type)
+	{
+	case DEVICE_NODE:
+		mock_freeDevices((s_Device *) nodePtr, recursive);
+		break;
+	case VARIABLE_NODE:
+		mock_freeVariables((s_Variable *) nodePtr, recursive);
+		break;
+	case TAG_NODE:
+		mock_freeTags((s_Tag *) nodePtr, recursive);
+		break;
+	case ID_NODE:
+		mock_freeIds((s_NodeId *) nodePtr, recursive);
+		break;
+	default:
+		status = DM_MOCK_ERROR;
+		break;
+	}
+	DTSE_STATS_END(DTSE_STATS_DM_FREE_NODE, start);
+	return status;
+}
+
+DTSE_int DM_Open_Query_Session()
+{
+	DTSE_int session;
+
+	DTSE_STATS_BEGIN(start);
+	pthread_mutex_lock(&mock_lock);
+	mock_counters.sessions++;
+	session = mock_opened ? mock_nextSession++ : DM_MOCK_ERROR;
+	pthread_mutex_unlock(&mock_lock);
+	DTSE_STATS_END(DTSE_STATS_DM_OPEN_QUERY_SESSION, start);
+	return session;
+}
+
+DTSE_int DM_Close_Query_Session(DTSE_int sessionId)
+{
+	DTSE_int status;
+
+	DTSE_STATS_BEGIN(start);
+	status = sessionId >= 0 ? DTSE_SUCCESS : DM_MOCK_ERROR;
+	DTSE_STATS_END(DTSE_STATS_DM_CLOSE_QUERY_SESSION, start);
+	return status;
+}
+
+DTSE_STATUS DM_NotifyOnChange(char * deviceId, char * variable_id, void (*pfn)(char * deviceID, char *variableID))
+{
+	DTSE_STATUS status = DM_MOCK_ERROR;
+	DTSE_int d, v = -1;
+
+	pthread_mutex_lock(&mock_lock);
+	d = mock_deviceIndex(deviceId);
+	if (variable_id != NULL)
+		v = mock_variableIndex(variable_id);
+	if (pfn != NULL && d >= 0 && (variable_id == NULL || v >= 0) && mock_nbSubscriptions < mock_maxSubscriptions)
+	{
+		mock_subscriptions[mock_nbSubscriptions].device   = d;
+		mock_subscriptions[mock_nbSubscriptions].variable = v;
+		mock_subscriptions[mock_nbSubscriptions].pfn      = pfn;
+		mock_nbSubscriptions++;
+		status = DTSE_SUCCESS;
+	}
+	pthread_mutex_unlock(&mock_lock);
+	return status;
+}
@@ -0,0 +1,130 @@
+/********************************************************************************
+ * Schneider-Electric                                                           *
+ * Global Solutions - Digital Services Transformation                           *
+ * Digital Services Platform                                                    *
+ * Copyright (c) 2026 - All rights reserved.                                    *
+ *                                                                              *
+ * No part of this document may be reproduced in any form without the           *
+ * express written consent of Schneider-Electric.                               *
+ ********************************************************************************/
+
+/**
+ * @file
+ * In-memory implementation of the DMAPI (see dmapi.h) used by the DTSE benchmark.<br>
+ * The mock builds a synthetic data model of N devices holding M variables each.
+ * Every device carries one tag per namespace ("location", "protocol", ...) and every
+ * variable carries a "usage" tag, the tag instances being drawn from a Zipf distribution
+ * so that some tags are much more frequent than others, as on a real gateway.<br>
+ * All the DM_get... functions return deep copies that are released through DM_FreeNode(),
+ * which makes the allocation pattern of the DTSE identical to a production integration.
+ * When built with DTSE_ENABLE_STATS, the duration of each DMAPI call back is recorded in
+ * the DTSE_STATS_DM_... timers of DTSE_stats.h.
+ */
+
+#ifndef DMAPI_MOCK_H_
+#define DMAPI_MOCK_H_
+
+#include "dmapi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Configuration of the mocked data model.
+ *
+ * For detailed information, see struct DM_MockConfig_struct.
+ */
+typedef struct DM_MockConfig_struct	s_DM_MockConfig;
+
+/**
+ * @see s_DM_MockConfig
+ */
+struct DM_MockConfig_struct
+{
+	DTSE_int		nbDevices;				/**<  Number of devices in the data model */
+	DTSE_int		nbVariablesPerDevice;	/**<  Number of variables attached to each device */
+	DTSE_int		nbTagInstances;			/**<  Number of distinct instances per tag namespace */
+	double			tagSkew;				/**<  Zipf exponent of the tag instances distribution (0 = uniform) */
+	unsigned int	seed;					/**<  Seed of the pseudo random generator */
+};
+
+/**
+ * Calls counters of the mocked DMAPI functions.
+ *
+ * For detailed information, see struct DM_MockCounters_struct.
+ */
+typedef struct DM_MockCounters_struct	s_DM_MockCounters;
+
+/**
+ * @see s_DM_MockCounters
+ */
+struct DM_MockCounters_struct
+{
+	unsigned long	getDevice;				/**<  DM_GetDevice and DM_GetDevice... calls */
+	unsigned long	getVariable;			/**<  DM_GetVariable and DM_GetVariable... calls */
+	unsigned long	getVariableValue;		/**<  DM_GetVariableValue calls */
+	unsigned long	getDevicesByTags;		/**<  DM_GetDevices_ByTags calls */
+	unsigned long	getVariablesByTags;		/**<  DM_GetVariables_ByTags calls */
+	unsigned long	freeNode;				/**<  DM_FreeNode calls */
+	unsigned long	sessions;				/**<  DM_Open_Query_Session calls */
+	unsigned long	changes;				/**<  Data model changes applied by DM_Mock_Churn */
+	unsigned long	notifications;			/**<  Change notifications sent to the DTSE */
+};
+
+/**
+ * Fills the configuration structure with the default values
+ * (100 devices, 8 variables per device, 16 instances per namespace, skew 1.0).
+ *
+ * @param[out] config : Non NULL pointer on the configuration to fill
+ */
+void		DM_Mock_DefaultConfig	(s_DM_MockConfig * config);
+
+/**
+ * Sets the configuration used by the next DM_Open() call.
+ * @note Must be called before DM_Open(), the default configuration is used otherwise.
+ *
+ * @param[in] config : Non NULL pointer on the configuration
+ *
+ * @return DTSE_SUCCESS on success or a negative value for error (see DTSE_errorCodes.h)
+ */
+DTSE_STATUS	DM_Mock_Configure		(const s_DM_MockConfig * config);
+
+/**
+ * Simulates data model changes : for each change, a device is picked randomly and one of
+ * its tags is moved to another instance. The call backs registered on this device through
+ * DM_NotifyOnChange() are then triggered with a NULL variable identifier.
+ * @note No change is possible when the configuration has a single instance per namespace.
+ *
+ * @param[in] nbChanges : number of changes to simulate
+ *
+ * @return the number of changes applied to the data model
+ */
+DTSE_int	DM_Mock_Churn			(DTSE_int nbChanges);
+
+/**
+ * Returns the identifiers of the device and variable at the given indexes.
+ * The returned strings are owned by the mock and remain valid until DM_Close().
+ *
+ * @param[in] deviceIndex : index of the device, in [0, nbDevices[
+ * @param[in] variableIndex : index of the variable, in [0, nbVariablesPerDevice[
+ * @param[out] deviceId : pointer to store the device identifier
+ * @param[out] variableId : pointer to store the variable identifier
+ *
+ * @return DTSE_SUCCESS on success or a negative value for error (see DTSE_errorCodes.h)
+ */
+DTSE_STATUS	DM_Mock_GetIds			(DTSE_int deviceIndex, DTSE_int variableIndex,
+									 char ** deviceId, char ** variableId);
+
+/**
+ * Copies the calls counters of the mocked DMAPI functions.
+ *
+ * @param[out] counters : Non NULL pointer to store the counters
+ */
+void		DM_Mock_GetCounters		(s_DM_MockCounters * counters);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DMAPI_MOCK_H_ */
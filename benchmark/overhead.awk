@@ -0,0 +1,51 @@
+# Compares the outputs of dtse_bench_nostats (variant=disabled) and dtse_bench (variant=enabled).
+# For each measure, the best mean of the runs is kept, then the relative cost of the
+# statistics is written as one JSON object per line :
+#   {"bench":"overhead","name":...,"disabled_us":...,"enabled_us":...,"overhead_pct":...}
+# The ingest throughput is compared as a time per point.
+
+function field(line, key,    start)
+{
+	if (!match(line, "\"" key "\":[-0-9.e+]+"))
+		return ""
+	start = RSTART + length(key) + 3
+	return substr(line, start, RSTART + RLENGTH - start) + 0
+}
+
+function keep(name, value)
+{
+	if (value == "" || value <= 0)
+		return
+	if (!(name in order))
+	{
+		order[name] = ++nbNames
+		names[nbNames] = name
+	}
+	if (!((variant, name) in best) || value < best[variant, name])
+		best[variant, name] = value
+}
+
+/"bench":"ingest"/ {
+	pps = field($0, "points_per_sec")
+	if (pps != "" && pps > 0)
+		keep("\"ingest_per_point\"", 1e6 / pps)
+	next
+}
+
+/"bench":"(latency|query)"/ {
+	if (match($0, /"name":"([^"\\]|\\.)*"/))
+		keep(substr($0, RSTART + 7, RLENGTH - 7), field($0, "mean_us"))
+}
+
+END {
+	for (i = 1; i <= nbNames; i++)
+	{
+		name = names[i]
+		if (!(("disabled", name) in best) || !(("enabled", name) in best))
+			continue
+		disabled = best["disabled", name]
+		enabled = best["enabled", name]
+		printf "{\"bench\":\"overhead\",\"name\":%s,\"disabled_us\":%.4f,\"enabled_us\":%.4f,\"overhead_pct\":%.2f}\n", \
+			name, disabled, enabled, 100.0 * (enabled - disabled) / disabled
+	}
+}
@@ -0,0 +1,76 @@
+/********************************************************************************
+ * Schneider-Electric                                                           *
+ * Global Solutions - Digital Services Transformation                           *
+ * Digital Services Platform                                                    *
+ * Copyright (c) 2026 - All rights reserved.                                    *
+ *                                                                              *
+ * No part of this document may be reproduced in any form without the           *
+ * express written consent of Schneider-Electric.                               *
+ ********************************************************************************/
+
+/**
+ * @file
+ * Synthetic sensor time series generator, see ts_workload.h
+ */
+
+#include <math.h>
+
+#include "ts_workload.h"
+#include "bench_random.h"
+
+#define TS_WORKLOAD_DAY		86400.0
+#define TS_WORKLOAD_PI		3.14159265358979323846
+
+/* Box-Muller, standard normal distribution */
+static double workload_gaussian(s_TS_Generator * generator)
+{
+	double u1 = Bench_RandomUniform(&generator->rng);
+	double u2 = Bench_RandomUniform(&generator->rng);
+
+	if (u1 < 1e-300)
+		u1 = 1e-300;
+	return sqrt(-2.0 * log(u1)) * cos(2.0 * TS_WORKLOAD_PI * u2);
+}
+
+void TS_Workload_DefaultConfig(s_TS_WorkloadConfig * config, double base)
+{
+	config->start          = 1546300800;	/* 2019-01-01T00:00:00 UTC */
+	config->cadence        = 10;
+	config->jitter         = 0.05;
+	config->gapProbability = 0.001;
+	config->gapMaxLength   = 60;
+	config->base           = base;
+	config->amplitude      = base * 0.2;
+	config->noise          = base * 0.01;
+}
+
+void TS_Workload_Init(s_TS_Generator * generator, const s_TS_WorkloadConfig * config, unsigned int seed)
+{
+	generator->config = *config;
+	generator->time   = config->start;
+	generator->rng    = 0x9E3779B97F4A7C15ULL ^ ((unsigned long long) seed * 0xBF58476D1CE4E5B9ULL);
+	if (generator->rng == 0)
+		generator->rng = 1;
+	generator->phase  = Bench_RandomUniform(&generator->rng) * 2.0 * TS_WORKLOAD_PI;
+}
+
+void TS_Workload_Next(s_TS_Generator * generator, DTSE_time * time, DTSE_double * value)
+{
+	const s_TS_WorkloadConfig * config = &generator->config;
+	double period = config->cadence * (1.0 + config->jitter * (2.0 * Bench_RandomUniform(&generator->rng) - 1.0));
+	double daily;
+
+	/* outage : skip a random number of samples */
+	if (config->gapMaxLength > 0 && Bench_RandomUniform(&generator->rng) < config->gapProbability)
+		period += config->cadence * (1 + (DTSE_int)(Bench_RandomUniform(&generator->rng) * config->gapMaxLength));
+
+	if (period < 1.0)
+		period = 1.0;
+	generator->time += (DTSE_time)(period + 0.5);
+
+	daily = sin(2.0 * TS_WORKLOAD_PI * fmod((double) generator->time, TS_WORKLOAD_DAY) / TS_WORKLOAD_DAY
+				+ generator->phase);
+
+	*time  = generator->time;
+	*value = config->base + config->amplitude * daily + config->noise * workload_gaussian(generator);
+}
@@ -0,0 +1,99 @@
+/********************************************************************************
+ * Schneider-Electric                                                           *
+ * Global Solutions - Digital Services Transformation                           *
+ * Digital Services Platform                                                    *
+ * Copyright (c) 2026 - All rights reserved.                                    *
+ *                                                                              *
+ * No part of this document may be reproduced in any form without the           *
+ * express written consent of Schneider-Electric.                               *
+ ********************************************************************************/
+
+/**
+ * @file
+ * Synthetic sensor time series generator used by the DTSE benchmark.<br>
+ * Each generator produces (time, value) samples with a nominal cadence and a jitter,
+ * occasional gaps (sensor or network outages), a daily cycle and a gaussian noise,
+ * which is close to what the DTSE receives from real field devices.
+ */
+
+#ifndef TS_WORKLOAD_H_
+#define TS_WORKLOAD_H_
+
+#include "TS_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Shape of a synthetic time series.
+ *
+ * For detailed information, see struct TS_WorkloadConfig_struct.
+ */
+typedef struct TS_WorkloadConfig_struct	s_TS_WorkloadConfig;
+
+/**
+ * @see s_TS_WorkloadConfig
+ */
+struct TS_WorkloadConfig_struct
+{
+	DTSE_time		start;			/**<  Timestamp of the first sample (seconds) */
+	DTSE_int		cadence;		/**<  Nominal period between two samples (seconds) */
+	double			jitter;			/**<  Maximum deviation of the period, as a fraction of the cadence */
+	double			gapProbability;	/**<  Probability that a sample starts an outage */
+	DTSE_int		gapMaxLength;	/**<  Maximum number of samples lost during an outage */
+	double			base;			/**<  Mean value of the signal */
+	double			amplitude;		/**<  Amplitude of the daily cycle */
+	double			noise;			/**<  Standard deviation of the gaussian noise */
+};
+
+/**
+ * Generator state, one per time series.
+ *
+ * For detailed information, see struct TS_Generator_struct.
+ */
+typedef struct TS_Generator_struct	s_TS_Generator;
+
+/**
+ * @see s_TS_Generator
+ */
+struct TS_Generator_struct
+{
+	s_TS_WorkloadConfig		config;		/**<  Shape of the time series */
+	DTSE_time				time;		/**<  Timestamp of the next sample */
+	double					phase;		/**<  Phase of the daily cycle, differs between series */
+	unsigned long long		rng;		/**<  State of the pseudo random generator */
+};
+
+/**
+ * Fills the configuration with a 10 seconds cadence, 5% jitter, rare short gaps
+ * and a daily cycle around the given base value.
+ *
+ * @param[out] config : Non NULL pointer on the configuration to fill
+ * @param[in] base : mean value of the signal
+ */
+void	TS_Workload_DefaultConfig	(s_TS_WorkloadConfig * config, double base);
+
+/**
+ * Initializes a generator.
+ *
+ * @param[out] generator : Non NULL pointer on the generator
+ * @param[in] config : shape of the time series
+ * @param[in] seed : seed of the pseudo random generator, use a different seed per series
+ */
+void	TS_Workload_Init			(s_TS_Generator * generator, const s_TS_WorkloadConfig * config, unsigned int seed);
+
+/**
+ * Produces the next sample of the time series.
+ *
+ * @param[in,out] generator : Non NULL pointer on the generator
+ * @param[out] time : timestamp of the sample
+ * @param[out] value : value of the sample
+ */
+void	TS_Workload_Next			(s_TS_Generator * generator, DTSE_time * time, DTSE_double * value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TS_WORKLOAD_H_ */